@@ -30,6 +30,10 @@
 #include "../GreaperCore/Public/SlimTaskScheduler.h"
 #include <random>
 #include <iostream>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <mutex>
 
 #if PLT_WINDOWS
 #define PLT_NAME "Win"
@@ -58,6 +62,8 @@ constexpr greaper::StringView CORE_LIB_NAME = { CORE_LIBRARY_NAME };
 constexpr greaper::StringView GAL_LIB_NAME = { GAL_LIBRARY_NAME };
 constexpr greaper::StringView LibFnName = "_Greaper"sv;
 constexpr static bool AsyncLog = true;
+constexpr static bool TraceTimeline = true;
+constexpr greaper::StringView TimelineTraceFileName = "TimelineTrace.json"sv;
 greaper::PLibrary gCoreLib, gGALLib;
 greaper::PGreaperLib gCore, gGAL;
 greaper::PApplication gApplication;
@@ -68,8 +74,153 @@ greaper::PCommandManager gCommandManager;
 
 #define APPLICATION_VERSION VERSION_SETTER(1, 0, 0, 0)
 
+// Replaces the global operator new/delete to count allocations, only enable it to run the serialization benchmarks
+#define RUN_SERIALIZATION_BENCHMARKS 0
+
 #define TRYEXP(exp, msg) { if(!exp) { DEBUG_OUTPUT(msg); TRIGGER_BREAKPOINT(); exit(EXIT_FAILURE); } }
 
+// Counts the global operator new and cJSON allocations done by the current thread while counting is enabled.
+// Greaper containers and strings allocate through Greaper's own allocator and are not counted.
+static thread_local bool tCountAllocations = false;
+static thread_local sizet tAllocationCount = 0;
+
+#if RUN_SERIALIZATION_BENCHMARKS
+void* operator new(std::size_t size)
+{
+	if (tCountAllocations)
+		++tAllocationCount;
+	if (void* ptr = std::malloc(size > 0 ? size : 1))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr)noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, UNUSED std::size_t size)noexcept
+{
+	std::free(ptr);
+}
+#endif
+
+static void* CountingJSONMalloc(size_t size)
+{
+	if (tCountAllocations)
+		++tAllocationCount;
+	return std::malloc(size);
+}
+
+static void CountingJSONFree(void* ptr)
+{
+	std::free(ptr);
+}
+
+// Startup and shutdown timeline, each phase is exported as a Chrome trace complete event,
+// phases that never finished (exit called while they were running) are exported as begin events
+struct TimelineEvent
+{
+	const achar* Name;
+	const achar* Category;
+	greaper::Timepoint_t Begin;
+	greaper::Timepoint_t End;
+	uint32 ThreadIndex;
+	bool Finished;
+};
+
+static const greaper::Timepoint_t gTimelineOrigin = greaper::Clock_t::now();
+static greaper::Vector<TimelineEvent> gTimelineEvents;
+static std::mutex gTimelineMutex;
+static std::atomic<uint32> gTimelineThreadCount{ 0 };
+static constexpr sizet TimelineEventReserve = 64;
+static constexpr sizet InvalidTimelineEvent = std::numeric_limits<sizet>::max();
+
+static uint32 GetTimelineThreadIndex()
+{
+	thread_local const uint32 threadIndex = gTimelineThreadCount.fetch_add(1, std::memory_order_relaxed);
+	return threadIndex;
+}
+
+class TimelinePhase
+{
+	sizet m_EventIndex = InvalidTimelineEvent;
+
+public:
+	TimelinePhase(UNUSED const achar* name, UNUSED const achar* category)noexcept
+	{
+		if constexpr (TraceTimeline)
+		{
+			TimelineEvent evt{ name, category, greaper::Clock_t::now(), {}, GetTimelineThreadIndex(), false };
+			std::lock_guard<std::mutex> lock(gTimelineMutex);
+			try
+			{
+				gTimelineEvents.push_back(evt);
+				m_EventIndex = gTimelineEvents.size() - 1;
+			}
+			catch (const std::bad_alloc&)
+			{
+				// The phase is not traced
+			}
+		}
+	}
+
+	~TimelinePhase()
+	{
+		if constexpr (TraceTimeline)
+		{
+			if (m_EventIndex == InvalidTimelineEvent)
+				return;
+
+			const auto end = greaper::Clock_t::now();
+			std::lock_guard<std::mutex> lock(gTimelineMutex);
+			auto& evt = gTimelineEvents[m_EventIndex];
+			evt.End = end;
+			evt.Finished = true;
+		}
+	}
+
+	TimelinePhase(const TimelinePhase&) = delete;
+	TimelinePhase& operator=(const TimelinePhase&) = delete;
+};
+
+static void WriteTimelineTrace()
+{
+	using namespace greaper;
+
+	auto toMicroseconds = [](Clock_t::duration duration) { return std::chrono::duration<double, std::micro>(duration).count(); };
+
+	auto root = SPtr<cJSON>(cJSON_CreateObject(), cJSON_Delete);
+	auto* traceEvents = cJSON_AddArrayToObject(root.get(), "traceEvents");
+	{
+		std::lock_guard<std::mutex> lock(gTimelineMutex);
+		for (const auto& evt : gTimelineEvents)
+		{
+			auto* eventJSON = cJSON_CreateObject();
+			cJSON_AddStringToObject(eventJSON, "name", evt.Name);
+			cJSON_AddStringToObject(eventJSON, "cat", evt.Category);
+			cJSON_AddStringToObject(eventJSON, "ph", evt.Finished ? "X" : "B");
+			cJSON_AddNumberToObject(eventJSON, "ts", toMicroseconds(evt.Begin - gTimelineOrigin));
+			if (evt.Finished)
+				cJSON_AddNumberToObject(eventJSON, "dur", toMicroseconds(evt.End - evt.Begin));
+			cJSON_AddNumberToObject(eventJSON, "pid", 0);
+			cJSON_AddNumberToObject(eventJSON, "tid", evt.ThreadIndex);
+			cJSON_AddItemToArray(traceEvents, eventJSON);
+		}
+	}
+	cJSON_AddStringToObject(root.get(), "displayTimeUnit", "ms");
+
+	auto text = SPtr<char>(cJSON_PrintUnformatted(root.get()), cJSON_free);
+	std::ofstream file{ String{ TimelineTraceFileName } };
+	if (!file.is_open())
+	{
+		DEBUG_OUTPUT("Couldn't open the timeline trace file.");
+		return;
+	}
+	file << text.get();
+	std::cout << Format("Timeline trace written to %s.", TimelineTraceFileName.data()) << std::endl;
+}
+
 static int MainCode(void* hInstance, int argc, char** argv);
 
 #if PLT_WINDOWS
@@ -103,6 +254,7 @@ int main(int argc, char* argv[])
 static void SetProperties(void* hInstance, int32 argc, achar** argv)
 {
 	using namespace greaper;
+	TimelinePhase phase{ "SetProperties", "Startup" };
 
 	auto propAppInstanceRes = CreateProperty<ptruint>((WGreaperLib)gCore, IApplication::AppInstanceName, (ptruint)hInstance, ""sv, true, true, {});
 	if (propAppInstanceRes.HasFailed())
@@ -132,6 +284,7 @@ static void SetProperties(void* hInstance, int32 argc, achar** argv)
 static void ActivateManagers()
 {
 	using namespace greaper;
+	TimelinePhase phase{ "ActivateManagers", "Startup" };
 	auto app = gCore->GetApplication();
 	TRYEXP(!app.expired(), CORE_LIBRARY_NAME " does not have an Application.");
 	gApplication = app.lock();
@@ -155,29 +308,49 @@ static void ActivateManagers()
 		gCommandManager = (PCommandManager)mgrRes.GetValue();
 	}
 
-	gApplication->ActivateInterface((const PInterface&)gThreadManager);
-	gApplication->ActivateInterface((const PInterface&)gLogManager);
-	gApplication->ActivateInterface((const PInterface&)gCommandManager);
+	{
+		TimelinePhase activatePhase{ "ActivateInterface ThreadManager", "Startup" };
+		gApplication->ActivateInterface((const PInterface&)gThreadManager);
+	}
+	{
+		TimelinePhase activatePhase{ "ActivateInterface LogManager", "Startup" };
+		gApplication->ActivateInterface((const PInterface&)gLogManager);
+	}
+	{
+		TimelinePhase activatePhase{ "ActivateInterface CommandManager", "Startup" };
+		gApplication->ActivateInterface((const PInterface&)gCommandManager);
+	}
 }
 
 static void GreaperCoreLibInit(void* hInstance, int32 argc, achar** argv)
 {
 	using namespace greaper;
+	TimelinePhase phase{ "GreaperCoreLibInit", "Startup" };
 
-	gCoreLib = ConstructShared<Library>(CORE_LIB_NAME);
+	{
+		TimelinePhase libraryPhase{ "Library " CORE_LIBRARY_NAME, "Startup" };
+		gCoreLib = ConstructShared<Library>(CORE_LIB_NAME);
+	}
 	TRYEXP(gCoreLib->IsOpen(), "Couldn't open " CORE_LIBRARY_NAME);
 
 	auto libFNRes = gCoreLib->GetFunctionT<void*>(LibFnName);
 	TRYEXP(libFNRes.IsOk(), CORE_LIBRARY_NAME " does not have the _Greaper function.");
 
 	// init GreaperCore
-	auto* corePtr = static_cast<PGreaperLib*>(libFNRes.GetValue()());
+	PGreaperLib* corePtr = nullptr;
+	{
+		TimelinePhase entryPhase{ "_Greaper", "Startup" };
+		corePtr = static_cast<PGreaperLib*>(libFNRes.GetValue()());
+	}
 	TRYEXP(corePtr, CORE_LIBRARY_NAME " does not return a IGreaperLibrary.");
 	gCore = *corePtr;
 
 	SetProperties(hInstance, argc, argv);
 
-	gCore->InitLibrary(gCoreLib, PApplication());
+	{
+		TimelinePhase initPhase{ "InitLibrary " CORE_LIBRARY_NAME, "Startup" };
+		gCore->InitLibrary(gCoreLib, PApplication());
+	}
 
 	ActivateManagers();
 
@@ -192,6 +365,7 @@ static void GreaperCoreLibInit(void* hInstance, int32 argc, achar** argv)
 static void GreaperCoreLibClose()
 {
 	using namespace greaper;
+	TimelinePhase phase{ "GreaperCoreLibClose", "Shutdown" };
 
 	String appName = gApplication->GetApplicationName().lock()->GetValueCopy();
 	gCore->Log(Format("Closing %s...", appName.c_str()));
@@ -200,7 +374,10 @@ static void GreaperCoreLibClose()
 	gThreadManager.reset();
 	gLogManager.reset();
 	gApplication.reset();
-	gCore->DeinitLibrary();
+	{
+		TimelinePhase deinitPhase{ "DeinitLibrary " CORE_LIBRARY_NAME, "Shutdown" };
+		gCore->DeinitLibrary();
+	}
 	gCore.reset();
 }
 
@@ -704,11 +881,350 @@ static void TestFunction()
 	}
 }
 
+struct SerializationResult
+{
+	greaper::Clock_t::duration Duration{};
+	sizet ByteCount = 0;
+	sizet AllocationsPerOp = 0;
+};
+
+// Runs the operation once with allocation counting enabled, kept out of the timed loops as the cJSON hooks disable its realloc path
+template<class TOperation>
+static sizet CountOperationAllocations(TOperation operation)
+{
+	cJSON_Hooks countingHooks{ &CountingJSONMalloc, &CountingJSONFree };
+	cJSON_InitHooks(&countingHooks);
+	tAllocationCount = 0;
+	tCountAllocations = true;
+	operation();
+	tCountAllocations = false;
+	cJSON_InitHooks(nullptr);
+	return tAllocationCount;
+}
+
+template<class TOperation>
+static SerializationResult MeasureSerialization(sizet iterations, TOperation operation)
+{
+	using namespace greaper;
+
+	SerializationResult result{};
+	Timepoint_t begin = Clock_t::now();
+	for (sizet i = 0; i < iterations; ++i)
+		result.ByteCount += operation();
+	result.Duration = Clock_t::now() - begin;
+	result.AllocationsPerOp = CountOperationAllocations(operation);
+
+	return result;
+}
+
+// Resets the destination before every iteration outside the timed region, so releasing the previous result is not measured
+template<class TReset, class TOperation>
+static SerializationResult MeasureDeserialization(sizet iterations, TReset reset, TOperation operation)
+{
+	using namespace greaper;
+
+	SerializationResult result{};
+	for (sizet i = 0; i < iterations; ++i)
+	{
+		reset();
+		Timepoint_t begin = Clock_t::now();
+		result.ByteCount += operation();
+		result.Duration += Clock_t::now() - begin;
+	}
+	reset();
+	result.AllocationsPerOp = CountOperationAllocations(operation);
+
+	return result;
+}
+
+static void ReportSerializationTest(greaper::StringView testName, sizet objectCount, sizet iterations, const SerializationResult& result)
+{
+	using namespace greaper;
+
+	const auto seconds = std::chrono::duration<double>(result.Duration).count();
+	const auto megaBytesPerSec = ((double)result.ByteCount / (1024.0 * 1024.0)) / seconds;
+	const auto objectsPerSec = (double)(objectCount * iterations) / seconds;
+
+	std::cout << Format("%s:\t%.3f MB/s, %.0f objects/s, %" PRIuPTR " new/cJSON allocs/op.\n", testName.data(), megaBytesPerSec, objectsPerSec, result.AllocationsPerOp);
+}
+
+// Keeps the first failure of a benchmark operation, so it can be reported once the timed loop is over
+template<class TResult>
+static bool RecordFailure(greaper::String& failMessage, const TResult& res)
+{
+	if (!res.HasFailed())
+		return false;
+	if (failMessage.empty())
+		failMessage = res.GetFailMessage();
+	return true;
+}
+
+static void ReportFailure(greaper::StringView testName, const greaper::String& failMessage)
+{
+	using namespace greaper;
+
+	if (!failMessage.empty())
+		std::cout << Format("%s failed, results are not valid: %s\n", testName.data(), failMessage.c_str());
+}
+
+template<class T>
+static void SerializationBenchmark(greaper::StringView testName, const T& value, sizet objectCount, sizet iterations)
+{
+	using namespace greaper;
+	using typeInfo = typename refl::TypeInfo_t<T>::Type;
+
+	const auto streamSize = (uint64)typeInfo::StaticSize + (uint64)typeInfo::GetDynamicSize(value);
+	MemoryStream ms{ streamSize };
+	String toStreamFail, fromStreamFail, fromJSONFail;
+
+	auto toStream = MeasureSerialization(iterations, [&]()
+		{
+			ms.Seek(0);
+			RecordFailure(toStreamFail, typeInfo::ToStream(value, ms));
+			return (sizet)streamSize;
+		});
+
+	T readValue{};
+	auto resetReadValue = [&readValue]() { readValue = T{}; };
+
+	auto fromStream = MeasureDeserialization(iterations, resetReadValue, [&]()
+		{
+			ms.Seek(0);
+			RecordFailure(fromStreamFail, typeInfo::FromStream(readValue, ms));
+			return (sizet)streamSize;
+		});
+
+	auto toJSON = MeasureSerialization(iterations, [&]()
+		{
+			auto json = typeInfo::CreateJSON(value, testName);
+			auto* text = cJSON_Print(json.get());
+			const auto textSize = strlen(text);
+			cJSON_free(text);
+			return textSize;
+		});
+
+	auto json = typeInfo::CreateJSON(value, testName);
+	auto text = SPtr<char>(cJSON_Print(json.get()), cJSON_free);
+	const auto textSize = strlen(text.get());
+
+	auto fromJSON = MeasureDeserialization(iterations, resetReadValue, [&]()
+		{
+			auto parsed = SPtr<cJSON>(cJSON_Parse(text.get()), cJSON_Delete);
+			RecordFailure(fromJSONFail, typeInfo::FromJSON(readValue, parsed.get(), testName));
+			return textSize;
+		});
+
+	auto toString = MeasureSerialization(iterations, [&]()
+		{
+			String str = typeInfo::ToString(value);
+			return str.size();
+		});
+
+	std::cout << Format("%s (%" PRIuPTR " objects, %" PRIuPTR " iterations):\n", testName.data(), objectCount, iterations);
+	ReportSerializationTest("\tToStream"sv, objectCount, iterations, toStream);
+	ReportFailure("\tToStream"sv, toStreamFail);
+	ReportSerializationTest("\tFromStream"sv, objectCount, iterations, fromStream);
+	ReportFailure("\tFromStream"sv, fromStreamFail);
+	ReportSerializationTest("\tCreateJSON+Print"sv, objectCount, iterations, toJSON);
+	ReportSerializationTest("\tParse+FromJSON"sv, objectCount, iterations, fromJSON);
+	ReportFailure("\tParse+FromJSON"sv, fromJSONFail);
+	ReportSerializationTest("\tToString"sv, objectCount, iterations, toString);
+}
+
+// Creates mutable properties owned by GreaperCore that are only used by the benchmarks, mixing plain, string and container values
+static greaper::Vector<greaper::SPtr<greaper::IProperty>> CreateBenchmarkProperties(const greaper::String& setName, sizet propertyCount)
+{
+	using namespace greaper;
+
+	Vector<SPtr<IProperty>> props;
+	props.reserve(propertyCount);
+
+	auto addProperty = [&props](const String& propName, auto value)
+		{
+			using T = decltype(value);
+			auto propRes = CreateProperty<T>((WGreaperLib)gCore, propName, std::move(value), ""sv, false, true, {});
+			if (propRes.HasFailed())
+			{
+				gCore->LogError(propRes.GetFailMessage());
+				return;
+			}
+			props.push_back(SPtr<IProperty>(propRes.GetValue()));
+		};
+
+	for (sizet i = 0; i < propertyCount; ++i)
+	{
+		const auto propName = Format("Benchmark_%s_%" PRIuPTR, setName.c_str(), i);
+		switch (i % 3)
+		{
+		case 0:
+			addProperty(propName, (uint32)i);
+			break;
+		case 1:
+			addProperty(propName, Format("Value_%" PRIuPTR, i));
+			break;
+		default:
+			addProperty(propName, StringVec{ Format("Elem_%" PRIuPTR "_0", i), Format("Elem_%" PRIuPTR "_1", i) });
+			break;
+		}
+	}
+	return props;
+}
+
+// Serializes a set of scratch properties and deserializes it into a second set of the same types, never touching the application properties
+static void PropertySerializationBenchmark(sizet propertyCount, sizet iterations)
+{
+	using namespace greaper;
+	using propTypeInfo = refl::TypeInfo<IProperty>::Type;
+
+	auto writeProps = CreateBenchmarkProperties(Format("Write%" PRIuPTR, propertyCount), propertyCount);
+	auto readProps = CreateBenchmarkProperties(Format("Read%" PRIuPTR, propertyCount), propertyCount);
+	if (writeProps.size() != propertyCount || readProps.size() != propertyCount)
+	{
+		std::cout << Format("IPropertySet (%" PRIuPTR " objects): couldn't create the benchmark properties.\n", propertyCount);
+		return;
+	}
+
+	StringVec propNames;
+	propNames.resize(propertyCount);
+	uint64 streamSize = 0;
+	for (sizet i = 0; i < propertyCount; ++i)
+	{
+		propNames[i] = Format("Elem_%" PRIuPTR, i);
+		streamSize += (uint64)propTypeInfo::StaticSize + (uint64)propTypeInfo::GetDynamicSize(*writeProps[i]);
+	}
+	MemoryStream ms{ streamSize };
+	String toStreamFail, fromStreamFail, fromJSONFail;
+
+	auto toStream = MeasureSerialization(iterations, [&]()
+		{
+			ms.Seek(0);
+			for (const auto& prop : writeProps)
+			{
+				if (RecordFailure(toStreamFail, propTypeInfo::ToStream(*prop, ms)))
+					break;
+			}
+			return (sizet)streamSize;
+		});
+
+	auto fromStream = MeasureSerialization(iterations, [&]()
+		{
+			ms.Seek(0);
+			for (const auto& prop : readProps)
+			{
+				if (RecordFailure(fromStreamFail, propTypeInfo::FromStream(*prop, ms)))
+					break;
+			}
+			return (sizet)streamSize;
+		});
+
+	auto toJSON = MeasureSerialization(iterations, [&]()
+		{
+			sizet byteCount = 0;
+			for (sizet i = 0; i < propertyCount; ++i)
+			{
+				auto propJSON = propTypeInfo::CreateJSON(*writeProps[i], propNames[i]);
+				auto* propText = cJSON_Print(propJSON.get());
+				byteCount += strlen(propText);
+				cJSON_free(propText);
+			}
+			return byteCount;
+		});
+
+	Vector<SPtr<char>> propTexts;
+	propTexts.resize(propertyCount);
+	sizet textSize = 0;
+	for (sizet i = 0; i < propertyCount; ++i)
+	{
+		auto propJSON = propTypeInfo::CreateJSON(*writeProps[i], propNames[i]);
+		propTexts[i] = SPtr<char>(cJSON_Print(propJSON.get()), cJSON_free);
+		textSize += strlen(propTexts[i].get());
+	}
+
+	auto fromJSON = MeasureSerialization(iterations, [&]()
+		{
+			for (sizet i = 0; i < propertyCount; ++i)
+			{
+				auto parsed = SPtr<cJSON>(cJSON_Parse(propTexts[i].get()), cJSON_Delete);
+				if (RecordFailure(fromJSONFail, propTypeInfo::FromJSON(*readProps[i], parsed.get(), propNames[i])))
+					break;
+			}
+			return textSize;
+		});
+
+	auto toString = MeasureSerialization(iterations, [&]()
+		{
+			sizet byteCount = 0;
+			for (const auto& prop : writeProps)
+				byteCount += propTypeInfo::ToString(*prop).size();
+			return byteCount;
+		});
+
+	std::cout << Format("IPropertySet (%" PRIuPTR " objects, %" PRIuPTR " iterations):\n", propertyCount, iterations);
+	ReportSerializationTest("\tToStream"sv, propertyCount, iterations, toStream);
+	ReportFailure("\tToStream"sv, toStreamFail);
+	ReportSerializationTest("\tFromStream"sv, propertyCount, iterations, fromStream);
+	ReportFailure("\tFromStream"sv, fromStreamFail);
+	ReportSerializationTest("\tCreateJSON+Print"sv, propertyCount, iterations, toJSON);
+	ReportSerializationTest("\tParse+FromJSON"sv, propertyCount, iterations, fromJSON);
+	ReportFailure("\tParse+FromJSON"sv, fromJSONFail);
+	ReportSerializationTest("\tToString"sv, propertyCount, iterations, toString);
+}
+
+static void SerializationBenchmarks()
+{
+	using namespace greaper;
+	using namespace math;
+
+	constexpr sizet elementCounts[] = { 64, 4'096, 262'144 };
+	constexpr sizet elementsPerSize = 1'048'576;
+	constexpr sizet nestedMapSize = 4;
+
+	std::random_device generator{};
+	std::uniform_real_distribution<float> distributionF(-1000.f, 1000.f);
+
+	std::cout << "Allocation counts only include the global operator new (inside Core only on ELF platforms) and cJSON, "
+		"allocations through Greaper's allocator are not counted.\n";
+
+	auto scalarStruct = std::pair<QuaternionReal<double>, Vector3Real<double>>{
+		QuaternionReal<double>::FromEuler(90.0 * DEG2RAD<double>, -60.0 * DEG2RAD<double>, 15.0 * DEG2RAD<double>),
+		Vector3Real<double>(90, -60, 15) };
+	SerializationBenchmark("ScalarStruct"sv, scalarStruct, 1, 100'000);
+
+	for (const auto elementCount : elementCounts)
+	{
+		const auto iterations = std::max(elementsPerSize / elementCount, (sizet)1);
+
+		Vector<float> podVector;
+		podVector.resize(elementCount, 0.f);
+		for (auto& elem : podVector)
+			elem = distributionF(generator);
+		SerializationBenchmark("PODVector"sv, podVector, elementCount, iterations);
+
+		Map<String, Map<String, String>> stringMap;
+		for (sizet i = 0; i < elementCount; ++i)
+		{
+			auto& nested = stringMap[Format("Key_%" PRIuPTR, i)];
+			for (sizet j = 0; j < nestedMapSize; ++j)
+				nested[Format("NestedKey_%" PRIuPTR, j)] = Format("Value_%" PRIuPTR "_%" PRIuPTR, i, j);
+		}
+		SerializationBenchmark("NestedStringMap"sv, stringMap, elementCount, iterations);
+	}
+
+	constexpr sizet propertyCounts[] = { 16, 256, 4'096 };
+	constexpr sizet propertiesPerSize = 65'536;
+	for (const auto propertyCount : propertyCounts)
+		PropertySerializationBenchmark(propertyCount, std::max(propertiesPerSize / propertyCount, (sizet)1));
+}
+
 static void GreaperGALLibInit()
 {
 	using namespace greaper;
+	TimelinePhase phase{ "GreaperGALLibInit", "Startup" };
 
-	gGALLib = ConstructShared<Library>(GAL_LIB_NAME);
+	{
+		TimelinePhase libraryPhase{ "Library " GAL_LIBRARY_NAME, "Startup" };
+		gGALLib = ConstructShared<Library>(GAL_LIB_NAME);
+	}
 	TRYEXP(gGALLib->IsOpen(), "Couldn't open " GAL_LIBRARY_NAME);
 
 	auto galRes = gApplication->RegisterGreaperLibrary(gGALLib);
@@ -725,6 +1241,7 @@ static void GreaperGALLibInit()
 static void GreaperGALLibClose()
 {
 	using namespace greaper;
+	TimelinePhase phase{ "GreaperGALLibClose", "Shutdown" };
 
 	auto res = gApplication->UnregisterGreaperLibrary(gGAL);
 	if (res.HasFailed())
@@ -827,6 +1344,7 @@ int MainCode(void* hInstance, int argc, char** argv)
 {
 	using namespace greaper;
 	const bool RunTests = true;
+	const bool RunSerializationBenchmarks = RUN_SERIALIZATION_BENCHMARKS;
 	const bool RunWindow = false;
 	const bool RunWaylandTest = PLT_LINUX;
 
@@ -838,6 +1356,13 @@ int MainCode(void* hInstance, int argc, char** argv)
 
 
 	OSPlatform::PerThreadInit();
+
+	// Registered at exit, so failed startups that call exit or throw also emit their trace
+	if constexpr (TraceTimeline)
+	{
+		gTimelineEvents.reserve(TimelineEventReserve);
+		std::atexit(&WriteTimelineTrace);
+	}
 	
 	try
 	{
@@ -847,6 +1372,8 @@ int MainCode(void* hInstance, int argc, char** argv)
 		if (RunTests)
 		{
 			TestFunction();
+			if (RunSerializationBenchmarks)
+				SerializationBenchmarks();
 			std::cout << "Test finished" << std::endl;
 			char c;
 			std::cin >> c;
@@ -860,7 +1387,10 @@ int MainCode(void* hInstance, int argc, char** argv)
 		//GreaperGALLibClose();
 		GreaperCoreLibClose();
 
-		gCoreLib->Close();
+		{
+			TimelinePhase closePhase{ "Library::Close " CORE_LIBRARY_NAME, "Shutdown" };
+			gCoreLib->Close();
+		}
 		gCoreLib.reset();
 	}
 	catch (const std::exception& e)